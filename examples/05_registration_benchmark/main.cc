@@ -0,0 +1,146 @@
+/**
+ * FShell SDK - Registration Benchmark
+ *
+ * This example measures how long it takes to register a large command set
+ * at startup, the way big plugins do it:
+ * - Creating a fresh shell instance per run
+ * - Registering N commands with fn_cmd_register()
+ * - Reporting total and per-command registration time
+ *
+ * Compile: See CMakeLists.txt in this directory
+ * Run:     ./registration_benchmark [count ...]
+ *          (defaults to 1000 10000 100000)
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <ctype.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "fn_api.h"
+
+#ifdef __cplusplus
+}
+#endif
+
+/* ============================================================================
+ * Benchmark Command Handler
+ * ============================================================================
+ */
+
+/**
+ * Shared no-op handler - every registered command points here
+ */
+FnResult cmd_noop(const FnCommandData *cmd, void *user_data) { return FN_OK; }
+
+/* ============================================================================
+ * Benchmark Runner
+ * ============================================================================
+ */
+
+/**
+ * Registers `count` commands on a fresh instance and prints the timings.
+ * Returns 0 on success, 1 if the instance could not be created or a
+ * registration failed.
+ */
+static int run_benchmark(size_t count) {
+  using Clock = std::chrono::steady_clock;
+
+  FnAPI *api = fn_create("RegistrationBenchmark");
+  if (!api) {
+    fprintf(stderr, "ERROR: Failed to create FShell instance\n");
+    return 1;
+  }
+
+  char name[64];
+  char help[96];
+
+  auto start = Clock::now();
+
+  for (size_t i = 0; i < count; ++i) {
+    snprintf(name, sizeof(name), "bench_cmd_%zu", i);
+    snprintf(help, sizeof(help), "Benchmark command number %zu", i);
+
+    FnResult result = fn_cmd_register(api, name, cmd_noop, api, help);
+    if (result != FN_OK) {
+      const char *reason = "unknown";
+      fn_result_string(result, &reason);
+      fprintf(stderr, "ERROR: Failed to register '%s': %s\n", name, reason);
+      fn_destroy(api);
+      return 1;
+    }
+  }
+
+  auto registered = Clock::now();
+  fn_destroy(api);
+  auto destroyed = Clock::now();
+
+  double register_ms =
+      std::chrono::duration<double, std::milli>(registered - start).count();
+  double destroy_ms =
+      std::chrono::duration<double, std::milli>(destroyed - registered).count();
+  double per_cmd_us = count ? (register_ms * 1000.0) / (double)count : 0.0;
+
+  printf("%10zu  %14.2f  %14.3f  %12.2f\n", count, register_ms, per_cmd_us,
+         destroy_ms);
+
+  return 0;
+}
+
+/* ============================================================================
+ * Main Application
+ * ============================================================================
+ */
+
+int main(int argc, char **argv) {
+  printf("FShell SDK - Registration Benchmark\n");
+  printf("===================================\n\n");
+
+  static const size_t default_counts[] = {1000, 10000, 100000};
+  static const unsigned long long max_count = 10000000;
+
+  printf("%10s  %14s  %14s  %12s\n", "commands", "register (ms)",
+         "per cmd (us)", "destroy (ms)");
+
+  if (argc > 1) {
+    for (int i = 1; i < argc; ++i) {
+      // strtoull() accepts signs and whitespace, so insist on a digit first
+      if (!isdigit((unsigned char)argv[i][0])) {
+        fprintf(stderr,
+                "ERROR: Invalid command count '%s' (expected 1-%llu)\n",
+                argv[i], max_count);
+        return 1;
+      }
+
+      char *end = NULL;
+      errno = 0;
+      unsigned long long count = strtoull(argv[i], &end, 10);
+      if (errno == ERANGE || *end != '\0' || count == 0 ||
+          count > max_count) {
+        fprintf(stderr,
+                "ERROR: Invalid command count '%s' (expected 1-%llu)\n",
+                argv[i], max_count);
+        return 1;
+      }
+      if (run_benchmark((size_t)count) != 0) {
+        return 1;
+      }
+    }
+  } else {
+    for (size_t count : default_counts) {
+      if (run_benchmark(count) != 0) {
+        return 1;
+      }
+    }
+  }
+
+  printf("\nDone.\n");
+  return 0;
+}